@@ -37,7 +37,7 @@ endfunction()
 # * Installs common Fortan modules to a per-compiler-version directory
 # * General Fortran formatting and configuration options
 # * Per-compiler configuration and options
-#   * MPAS_DOUBLE_PRECISION related flags
+#   * MPAS_DOUBLE_PRECISION and MPAS_MIXED_PRECISION related flags
 #
 # Args:
 #  <target_name> - The name of the target to prepare
@@ -83,6 +83,9 @@ function(mpas_fortran_target target)
             )
         else()
             list(APPEND MPAS_FORTRAN_TARGET_COMPILE_DEFINITIONS SINGLE_PRECISION)
+            if(MPAS_MIXED_PRECISION)
+                list(APPEND MPAS_FORTRAN_TARGET_COMPILE_DEFINITIONS MPAS_MIXED_PRECISION)
+            endif()
         endif()
     elseif(CMAKE_Fortran_COMPILER_ID MATCHES Intel)
         list(APPEND MPAS_FORTRAN_TARGET_COMPILE_OPTIONS_PUBLIC
@@ -95,6 +98,9 @@ function(mpas_fortran_target target)
             )
         else()
             list(APPEND MPAS_FORTRAN_TARGET_COMPILE_DEFINITIONS SINGLE_PRECISION)
+            if(MPAS_MIXED_PRECISION)
+                list(APPEND MPAS_FORTRAN_TARGET_COMPILE_DEFINITIONS MPAS_MIXED_PRECISION)
+            endif()
         endif()
     endif()
     target_compile_definitions(${target} PRIVATE ${MPAS_FORTRAN_TARGET_COMPILE_DEFINITIONS})